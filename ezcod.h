@@ -9,6 +9,12 @@
  * 
  *     All return -'ve value on failure, and as much of an error message as allowed by the 'siz' of
  * the supplied char* buffer.
+ * 
+ * ..._encode_batch -- Encode 'count' lat/lon into fixed-width (NUL-padded) ezcods, w/ per-item status
+ * ..._decode_batch -- Decode 'count' fixed-width ezcods into lat/lon, w/ per-item confidence
+ * 
+ *     Both return the number of items successfully encoded/decoded, or -1 on invalid parameters.
+ * Each item's status is 0 (or its confidence %), or a -'ve ezpwd::ezcod_base::ERR_... code.
  */
 #  if defined( __cplusplus )
 // Standard C Javascript binding implementation
@@ -27,6 +33,22 @@ extern "C" {
 				    double	       *lat,
 				    double	       *lon,
 				    double	       *acc );
+    int				ezcod_3_10_encode_batch(
+				    const double       *lat,
+				    const double       *lon,
+				    size_t		count,
+				    char	       *enc,
+				    size_t		width,
+				    size_t		pre,
+				    int		       *status );
+    int				ezcod_3_10_decode_batch(
+				    const char	       *dec,
+				    size_t		width,
+				    size_t		count,
+				    double	       *lat,
+				    double	       *lon,
+				    int		       *confidence,
+				    double	       *acc );
     /* ezcod 3:11 -- 9+2 Reed-Solomon parity symbols */
     int				ezcod_3_11_encode(
 				    double		lat,
@@ -40,6 +62,22 @@ extern "C" {
 				    double	       *lat,
 				    double	       *lon,
 				    double	       *acc );
+    int				ezcod_3_11_encode_batch(
+				    const double       *lat,
+				    const double       *lon,
+				    size_t		count,
+				    char	       *enc,
+				    size_t		width,
+				    size_t		pre,
+				    int		       *status );
+    int				ezcod_3_11_decode_batch(
+				    const char	       *dec,
+				    size_t		width,
+				    size_t		count,
+				    double	       *lat,
+				    double	       *lon,
+				    int		       *confidence,
+				    double	       *acc );
     /* ezcod 3:12 -- 9+3 Reed-Solomon parity symbols */
     int				ezcod_3_12_encode(
 				    double		lat,
@@ -53,6 +91,22 @@ extern "C" {
 				    double	       *lat,
 				    double	       *lon,
 				    double	       *acc );
+    int				ezcod_3_12_encode_batch(
+				    const double       *lat,
+				    const double       *lon,
+				    size_t		count,
+				    char	       *enc,
+				    size_t		width,
+				    size_t		pre,
+				    int		       *status );
+    int				ezcod_3_12_decode_batch(
+				    const char	       *dec,
+				    size_t		width,
+				    size_t		count,
+				    double	       *lat,
+				    double	       *lon,
+				    int		       *confidence,
+				    double	       *acc );
 #  if defined( __cplusplus )
 } // extern "C"
 
@@ -85,6 +139,28 @@ class [[jsexport]] ezcod_cheerp
     {
 	return ::ezcod_3_10_decode( dec, siz, lat, lon, acc );
     }
+    int				ezcod_3_10_encode_batch(
+				    const double       *lat,
+				    const double       *lon,
+				    size_t		count,
+				    char	       *enc,
+				    size_t		width,
+				    size_t		pre,
+				    int		       *status )
+    {
+	return ::ezcod_3_10_encode_batch( lat, lon, count, enc, width, pre, status );
+    }
+    int				ezcod_3_10_decode_batch(
+				    const char	       *dec,
+				    size_t		width,
+				    size_t		count,
+				    double	       *lat,
+				    double	       *lon,
+				    int		       *confidence,
+				    double	       *acc )
+    {
+	return ::ezcod_3_10_decode_batch( dec, width, count, lat, lon, confidence, acc );
+    }
     /* ezcod 3:11 -- 9+2 Reed-Solomon parity symbols */
     int				ezcod_3_11_encode(
 				    double		lat,
@@ -104,6 +180,28 @@ class [[jsexport]] ezcod_cheerp
     {
 	return ::ezcod_3_11_decode( dec, siz, lat, lon, acc );
     }
+    int				ezcod_3_11_encode_batch(
+				    const double       *lat,
+				    const double       *lon,
+				    size_t		count,
+				    char	       *enc,
+				    size_t		width,
+				    size_t		pre,
+				    int		       *status )
+    {
+	return ::ezcod_3_11_encode_batch( lat, lon, count, enc, width, pre, status );
+    }
+    int				ezcod_3_11_decode_batch(
+				    const char	       *dec,
+				    size_t		width,
+				    size_t		count,
+				    double	       *lat,
+				    double	       *lon,
+				    int		       *confidence,
+				    double	       *acc )
+    {
+	return ::ezcod_3_11_decode_batch( dec, width, count, lat, lon, confidence, acc );
+    }
     /* ezcod 3:12 -- 9+3 Reed-Solomon parity symbols */
     int				ezcod_3_12_encode(
 				    double		lat,
@@ -123,6 +221,28 @@ class [[jsexport]] ezcod_cheerp
     {
 	return ::ezcod_3_12_decode( dec, siz, lat, lon, acc );
     }
+    int				ezcod_3_12_encode_batch(
+				    const double       *lat,
+				    const double       *lon,
+				    size_t		count,
+				    char	       *enc,
+				    size_t		width,
+				    size_t		pre,
+				    int		       *status )
+    {
+	return ::ezcod_3_12_encode_batch( lat, lon, count, enc, width, pre, status );
+    }
+    int				ezcod_3_12_decode_batch(
+				    const char	       *dec,
+				    size_t		width,
+				    size_t		count,
+				    double	       *lat,
+				    double	       *lon,
+				    int		       *confidence,
+				    double	       *acc )
+    {
+	return ::ezcod_3_12_decode_batch( dec, width, count, lat, lon, confidence, acc );
+    }
 };
 #    endif // __cheerp
 #  endif // __cplusplus
@@ -144,3 +144,131 @@ ezcod_3_N_decode_wrap = function( func_name ) {
 ezcod_3_10_decode		= ezcod_3_N_decode_wrap( 'ezcod_3_10_decode' );
 ezcod_3_11_decode		= ezcod_3_N_decode_wrap( 'ezcod_3_11_decode' );
 ezcod_3_12_decode		= ezcod_3_N_decode_wrap( 'ezcod_3_12_decode' );
+
+// 
+// ezcod_3_<N>_encode_batch -- encodes many lat/lon as ezcod 3:<N> codes, in one native call
+// ezcod_3_<N>_decode_batch -- decodes many ezcod 3:<N> codes to lat/lon, in one native call
+// 
+// ezcod_3_<N>_encode_batch( lats, lons, pre ) --> [ <string>, ... ]
+// 
+//     Encodes each lats[i]/lons[i] (Arrays or Float64Arrays of equal length).  Any position that
+// cannot be encoded (eg. out of range) yields an empty string, instead of an exception.
+// 
+// ezcod_3_<N>_decode_batch( cods ) --> {
+//     confidence: <Int32Array>, latitude: <Float64Array>, longitude: <Float64Array>,
+//     accuracy: <Float64Array>, decoded: <int>
+// }
+// 
+//     Decodes the Array of EZCOD strings.  Each code's confidence is confidence[i], or a -'ve
+// error code if it could not be decoded (leaving its latitude/longitude/accuracy zero).  The
+// number successfully decoded is returned in decoded.
+// 
+//     All positions and codes are copied in/out of buffers in the Emscripten heap, and only one
+// call is made into the native code.
+// 
+ezcod_3_N_encode_batch_wrap = function( func_name ) {
+    var func			= Module.cwrap( func_name, 'number',
+                                                ['number'	// lat (count doubles)
+                                                 ,'number'	// lon (count doubles)
+                                                 ,'number'	// count
+                                                 ,'number'	// enc (count * width bytes)
+                                                 ,'number'	// width
+                                                 ,'number'	// precision (0 --> default 9)
+                                                 ,'number'] );	// status (count ints)
+    return function( lats, lons, pre ) {
+        if ( typeof pre == 'undefined' )
+            pre			= 0;	// the default precision (9 symbols)
+        var		count	= Math.min( lats.length, lons.length );
+        var		width	= 32;	// up to 12 location, 3 parity, separator, spaces and NUL
+        var		pos	= _malloc( count * 16 + 8 );
+        var		enc	= _malloc( count * width + 1 );
+        var		sts	= _malloc( count * 4 + 4 );
+        var		res	= -1;
+        var		ret	= [];
+        try { // must de-allocate pos, enc and sts after this point
+            var		lat	= pos >> 3;
+            var		lon	= lat + count;
+            HEAPF64.set( lats.slice( 0, count ), lat );
+            HEAPF64.set( lons.slice( 0, count ), lon );
+            res			= func( lat << 3, lon << 3, count, enc, width, pre|0, sts );
+            if ( res >= 0 ) {
+                for ( var i = 0; i < count; ++i ) {
+                    var	beg	= enc + i * width;
+                    var	end	= beg;
+                    while ( HEAPU8[end] )
+                        ++end;
+                    ret.push( String.fromCharCode.apply( null, HEAPU8.subarray( beg, end )));
+                }
+            }
+        } finally {
+            _free( pos );
+            _free( enc );
+            _free( sts );
+        }
+        if ( res < 0 )
+            throw new Error( func_name + "( ..., " + pre + " ) failed" );
+        return ret;
+    }
+}
+
+ezcod_3_10_encode_batch		= ezcod_3_N_encode_batch_wrap( 'ezcod_3_10_encode_batch' );
+ezcod_3_11_encode_batch		= ezcod_3_N_encode_batch_wrap( 'ezcod_3_11_encode_batch' );
+ezcod_3_12_encode_batch		= ezcod_3_N_encode_batch_wrap( 'ezcod_3_12_encode_batch' );
+
+ezcod_3_N_decode_batch_wrap = function( func_name ) {
+    var func			= Module.cwrap( func_name, 'number',
+                                                ['number'	// dec (count * width bytes)
+                                                 ,'number'	// width
+                                                 ,'number'	// count
+                                                 ,'number'	// lat (count doubles)
+                                                 ,'number'	// lon (count doubles)
+                                                 ,'number'	// confidence (count ints)
+                                                 ,'number'] );	// acc (count doubles)
+    return function( cods ) {
+        var		count	= cods.length;
+        var		width	= 1;
+        for ( var i = 0; i < count; ++i )
+            if ( cods[i].length + 1 > width )
+                width		= cods[i].length + 1;
+        var		pos	= _malloc( count * 24 + 8 );
+        var		dec	= _malloc( count * width + 1 );
+        var		cnf	= _malloc( count * 4 + 4 );
+        var		res	= -1;
+        var		ret;
+        try { // must de-allocate pos, dec and cnf after this point
+            var		lat	= pos >> 3;
+            var		lon	= lat + count;
+            var		acc	= lon + count;
+            HEAPF64.fill( 0, lat, lat + count * 3 );
+            HEAPU8.fill( 0, dec, dec + count * width );
+            for ( var i = 0; i < count; ++i ) {
+                var	cod	= cods[i];
+                var	beg	= dec + i * width;
+                for ( var j = 0; j < cod.length; ++j ) {
+                    var	c	= cod.charCodeAt( j );
+                    HEAPU8[beg + j] = c < 0x80 ? c : 0x7f; // non-ASCII are invalid symbols
+                }
+            }
+            res			= func( dec, width, count, lat << 3, lon << 3, cnf, acc << 3 );
+            if ( res >= 0 )
+                ret		= {
+                    confidence:	HEAP32.slice( cnf >> 2, ( cnf >> 2 ) + count ),
+                    latitude:	HEAPF64.slice( lat, lat + count ),
+                    longitude:	HEAPF64.slice( lon, lon + count ),
+                    accuracy:	HEAPF64.slice( acc, acc + count ),
+                    decoded:	res,
+                };
+        } finally {
+            _free( pos );
+            _free( dec );
+            _free( cnf );
+        }
+        if ( res < 0 )
+            throw new Error( func_name + "( ... ) failed" );
+        return ret;
+    }
+}
+
+ezcod_3_10_decode_batch		= ezcod_3_N_decode_batch_wrap( 'ezcod_3_10_decode_batch' );
+ezcod_3_11_decode_batch		= ezcod_3_N_decode_batch_wrap( 'ezcod_3_11_decode_batch' );
+ezcod_3_12_decode_batch		= ezcod_3_N_decode_batch_wrap( 'ezcod_3_12_decode_batch' );
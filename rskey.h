@@ -5,21 +5,39 @@
 extern "C" {
 #endif
 
+    // 
+    // rskey_<PARITY>_{en,de}code	-- Encode/decode one RSKEY, in place in buf
+    // rskey_<PARITY>_{en,de}code_batch	-- Encode/decode 'count' RSKEYs in one call
+    // 
+    //     The batch forms transform 'count' consecutive payloads of 'rawsiz' bytes in raw
+    // to/from 'count' consecutive, fixed-width, NUL-padded keys of 'width' bytes in keys.  They
+    // return the number of keys encoded/decoded (or -1 on invalid parameters); each key's
+    // confidence (or -1) is returned in confidence[i], if supplied.
+    // 
+
     // ABCDE-FG
     int rskey_2_encode( size_t rawsiz, char *buf, size_t buflen, size_t bufsiz, size_t sep );
     int rskey_2_decode( size_t rawsiz, char *buf, size_t buflen, size_t bufsiz );
+    int rskey_2_encode_batch( size_t rawsiz, const char *raw, size_t count, char *keys, size_t width, size_t sep );
+    int rskey_2_decode_batch( size_t rawsiz, const char *keys, size_t width, size_t count, char *raw, int *confidence );
 
     // ABCDE-FGH
     int rskey_3_encode( size_t rawsiz, char *buf, size_t buflen, size_t bufsiz, size_t sep );
     int rskey_3_decode( size_t rawsiz, char *buf, size_t buflen, size_t bufsiz );
+    int rskey_3_encode_batch( size_t rawsiz, const char *raw, size_t count, char *keys, size_t width, size_t sep );
+    int rskey_3_decode_batch( size_t rawsiz, const char *keys, size_t width, size_t count, char *raw, int *confidence );
 
     // ABCDE-FGH1
     int rskey_4_encode( size_t rawsiz, char *buf, size_t buflen, size_t bufsiz, size_t sep );
     int rskey_4_decode( size_t rawsiz, char *buf, size_t buflen, size_t bufsiz );
+    int rskey_4_encode_batch( size_t rawsiz, const char *raw, size_t count, char *keys, size_t width, size_t sep );
+    int rskey_4_decode_batch( size_t rawsiz, const char *keys, size_t width, size_t count, char *raw, int *confidence );
 
     // ABCDE-FGH1K
     int rskey_5_encode( size_t rawsiz, char *buf, size_t buflen, size_t bufsiz, size_t sep );
     int rskey_5_decode( size_t rawsiz, char *buf, size_t buflen, size_t bufsiz );
+    int rskey_5_encode_batch( size_t rawsiz, const char *raw, size_t count, char *keys, size_t width, size_t sep );
+    int rskey_5_decode_batch( size_t rawsiz, const char *keys, size_t width, size_t count, char *raw, int *confidence );
 
 
 #if defined( __cplusplus )
@@ -0,0 +1,136 @@
+/*
+ * rskey_bench.js -- Compare individual vs. batch RSKEY and EZCOD encode/decode throughput in Node.js
+ *
+ *     Encodes and decodes the same random payloads (and GPS positions) one at a time, via
+ * rskey_<PARITY>_encode/_decode (and ezcod_3_<N>_encode/_decode), and then all at once, via the
+ * ..._batch variants, which make only one call into the (WebAssembly) native code.  The results
+ * must agree.  Reports thousands of keys per second.
+ *
+ *     node ./rskey_bench.js [ <rskey.js> [ <ezcod.js> ]]
+ *
+ * Build the modules w/ 'make js/ezpwd/rskey.js js/ezpwd/ezcod.js' (w/ WebAssembly SIMD128, by
+ * default; add EMXX_SIMD= to compare against scalar builds).
+ */
+var rskey_js		= process.argv[2] || './js/ezpwd/rskey.js';
+var ezcod_js		= process.argv[3] || './js/ezpwd/ezcod.js';
+
+//
+// ready -- invoke run once the Emscripten module's runtime is initialized
+//
+function ready( mod, run ) {
+    if ( mod.calledRun )
+        run();
+    else
+        mod.onRuntimeInitialized = run;
+}
+
+function rate( count, begun ) {
+    var secs			= ( Date.now() - begun ) / 1000;
+    return ( count / ( secs > 0 ? secs : 0.001 ) / 1000 ).toFixed( 1 ) + " kkey/s";
+}
+
+function bench_rskey( parity, rawsiz, count ) {
+    var encode			= global['rskey_' + parity + '_encode'];
+    var decode			= global['rskey_' + parity + '_decode'];
+    var encode_batch		= global['rskey_' + parity + '_encode_batch'];
+    var decode_batch		= global['rskey_' + parity + '_decode_batch'];
+    var data			= new Uint8Array( count * rawsiz );
+    for ( var i = 0; i < data.length; ++i )
+        data[i]			= Math.random() * 256 | 0;
+
+    var keys			= [];
+    var begun			= Date.now();
+    for ( var i = 0; i < count; ++i )
+        keys.push( encode( rawsiz, data.slice( i * rawsiz, ( i + 1 ) * rawsiz ).buffer, 5 ));
+    var enc_one			= rate( count, begun );
+
+    begun			= Date.now();
+    var batch			= encode_batch( rawsiz, data, 5 );
+    var enc_bat			= rate( count, begun );
+    for ( var i = 0; i < count; ++i )
+        if ( batch[i] != keys[i] )
+            throw new Error( "rskey_" + parity + " key " + i + " differs: " + batch[i] + " != " + keys[i] );
+
+    // Corrupt every 4th key w/ an error in its first symbol
+    for ( var i = 0; i < count; i += 4 )
+        keys[i]			= ( keys[i][0] == 'X' ? 'Y' : 'X' ) + keys[i].slice( 1 );
+
+    var conf			= [];
+    begun			= Date.now();
+    for ( var i = 0; i < count; ++i ) {
+        try {
+            conf.push( decode( rawsiz, keys[i] ).confidence );
+        } catch ( exc ) {
+            conf.push( -1 );
+        }
+    }
+    var dec_one			= rate( count, begun );
+
+    begun			= Date.now();
+    var res			= decode_batch( rawsiz, keys );
+    var dec_bat			= rate( count, begun );
+    for ( var i = 0; i < count; ++i ) {
+        if ( res.confidence[i] != conf[i] )
+            throw new Error( "rskey_" + parity + " key " + i + " confidence differs: "
+                             + res.confidence[i] + " != " + conf[i] );
+        for ( var j = 0; conf[i] >= 0 && j < rawsiz; ++j )
+            if ( res.data[i * rawsiz + j] != data[i * rawsiz + j] )
+                throw new Error( "rskey_" + parity + " key " + i + " data differs" );
+    }
+    console.log( "rskey_" + parity + " (" + rawsiz + " bytes) encode: " + enc_one + " individual, "
+                 + enc_bat + " batch; decode: " + dec_one + " individual, " + dec_bat + " batch" );
+}
+
+function bench_ezcod( n, count ) {
+    var encode			= global['ezcod_3_' + n + '_encode'];
+    var decode			= global['ezcod_3_' + n + '_decode'];
+    var encode_batch		= global['ezcod_3_' + n + '_encode_batch'];
+    var decode_batch		= global['ezcod_3_' + n + '_decode_batch'];
+    var lats			= new Float64Array( count );
+    var lons			= new Float64Array( count );
+    for ( var i = 0; i < count; ++i ) {
+        lats[i]			= Math.random() * 180 -  90;
+        lons[i]			= Math.random() * 360 - 180;
+    }
+
+    var cods			= [];
+    var begun			= Date.now();
+    for ( var i = 0; i < count; ++i )
+        cods.push( encode( lats[i], lons[i] ));
+    var enc_one			= rate( count, begun );
+
+    begun			= Date.now();
+    var batch			= encode_batch( lats, lons );
+    var enc_bat			= rate( count, begun );
+    for ( var i = 0; i < count; ++i )
+        if ( batch[i] != cods[i] )
+            throw new Error( "ezcod_3_" + n + " code " + i + " differs: " + batch[i] + " != " + cods[i] );
+
+    var poss			= [];
+    begun			= Date.now();
+    for ( var i = 0; i < count; ++i )
+        poss.push( decode( cods[i] ));
+    var dec_one			= rate( count, begun );
+
+    begun			= Date.now();
+    var res			= decode_batch( cods );
+    var dec_bat			= rate( count, begun );
+    for ( var i = 0; i < count; ++i )
+        if ( res.confidence[i] != poss[i].confidence
+             || res.latitude[i] != poss[i].latitude || res.longitude[i] != poss[i].longitude )
+            throw new Error( "ezcod_3_" + n + " code " + i + " position differs" );
+    console.log( "ezcod_3_" + n + " encode: " + enc_one + " individual, " + enc_bat + " batch; decode: "
+                 + dec_one + " individual, " + dec_bat + " batch" );
+}
+
+var rskey			= require( rskey_js );
+ready( rskey, function() {
+    bench_rskey( 2,  8, 100000 );
+    bench_rskey( 3,  8, 100000 );
+    bench_rskey( 5, 12, 100000 );
+    var ezcod			= require( ezcod_js );
+    ready( ezcod, function() {
+        bench_ezcod( 10, 100000 );
+        bench_ezcod( 12, 100000 );
+    });
+});
@@ -186,3 +186,133 @@ rskey_2_decode		= rskey_N_decode_wrap( 'rskey_2_decode' );
 rskey_3_decode		= rskey_N_decode_wrap( 'rskey_3_decode' );
 rskey_4_decode		= rskey_N_decode_wrap( 'rskey_4_decode' );
 rskey_5_decode		= rskey_N_decode_wrap( 'rskey_5_decode' );
+
+// 
+// rskey_<PARITY>_encode_batch -- encodes many 'rawsiz' byte payloads to RSKEYs, in one native call
+// rskey_<PARITY>_decode_batch -- decodes many RSKEYs to 'rawsiz' byte payloads, in one native call
+// 
+// rskey_<PARITY>_encode_batch( rawsiz, data, sep ) --> [ <string>, ... ]
+// 
+//     The data (a Uint8Array or ArrayBuffer) holds data.length / rawsiz consecutive payloads of
+// exactly 'rawsiz' bytes.  Returns an Array of their RSKEYs.
+// 
+// rskey_<PARITY>_decode_batch( rawsiz, keys ) --> {
+//     confidence: <Int32Array>, data: <Uint8Array>, decoded: <int>
+// }
+// 
+//     Decodes the Array of RSKEY strings.  Key i's payload is data[i*rawsiz,(i+1)*rawsiz), and its
+// confidence (or -1 if it could not be decoded, leaving its payload zero) is confidence[i].  No
+// exception is raised for undecodable keys; the number successfully decoded is returned in
+// decoded.
+// 
+//     All payloads and keys are copied in/out of one buffer in the Emscripten heap, and only one
+// call is made into the native code; this is many times faster than calling rskey_<PARITY>_encode
+// or _decode for each key.  Only ASCII keys are supported.
+// 
+rskey_N_batch_width = function( rawsiz ) {
+    // room for up to 5 parity symbols, a separator between every symbol, and NUL
+    return 2 * ((( rawsiz * 8 + 4 ) / 5 | 0 ) + 5 ) + 1;
+}
+
+rskey_N_encode_batch_wrap = function( func_name ) {
+    var func			= Module.cwrap( func_name, 'number',
+                                                ['number'	// rawsiz
+                                                 ,'number'	// raw (count * rawsiz bytes)
+                                                 ,'number'	// count
+                                                 ,'number'	// keys (count * width bytes)
+                                                 ,'number'	// width
+                                                 ,'number'] );	// sep (output a '-' every n'th symbol)
+    return function( rawsiz, data, sep ) {
+        if ( typeof sep == 'undefined' )
+            sep			= 5;
+        if ( data instanceof ArrayBuffer )
+            data		= new Uint8Array( data );
+        else if ( ! ( data instanceof Uint8Array ))
+            throw new Error( "Unsupported data; must be Uint8Array or ArrayBuffer" );
+        rawsiz		       |= 0;
+        var		count	= rawsiz ? data.length / rawsiz | 0 : 0;
+        var		width	= rskey_N_batch_width( rawsiz );
+        var		raw	= _malloc( count * rawsiz + 1 );
+        var		keys	= _malloc( count * width + 1 );
+        var		res	= -1;
+        var		ret	= [];
+        try { // must de-allocate raw and keys after this point
+            HEAPU8.set( data.subarray( 0, count * rawsiz ), raw );
+            res			= func( rawsiz, raw, count, keys, width, sep|0 );
+            if ( res == count ) {
+                for ( var i = 0; i < count; ++i ) {
+                    var	beg	= keys + i * width;
+                    var	end	= beg;
+                    while ( HEAPU8[end] )
+                        ++end;
+                    ret.push( String.fromCharCode.apply( null, HEAPU8.subarray( beg, end )));
+                }
+            }
+        } finally {
+            _free( raw );
+            _free( keys );
+        }
+        if ( res != count )
+            throw new Error( func_name + "( " + rawsiz + ", ... ) failed" );
+        return ret;
+    }
+}
+
+rskey_2_encode_batch		= rskey_N_encode_batch_wrap( 'rskey_2_encode_batch' );
+rskey_3_encode_batch		= rskey_N_encode_batch_wrap( 'rskey_3_encode_batch' );
+rskey_4_encode_batch		= rskey_N_encode_batch_wrap( 'rskey_4_encode_batch' );
+rskey_5_encode_batch		= rskey_N_encode_batch_wrap( 'rskey_5_encode_batch' );
+
+rskey_N_decode_batch_wrap = function( func_name ) {
+    var func			= Module.cwrap( func_name, 'number',
+                                                ['number'	// rawsiz
+                                                 ,'number'	// keys (count * width bytes)
+                                                 ,'number'	// width
+                                                 ,'number'	// count
+                                                 ,'number'	// raw (count * rawsiz bytes)
+                                                 ,'number'] );	// confidence (count ints)
+    return function( rawsiz, keys ) {
+        rawsiz		       |= 0;
+        var		count	= keys.length;
+        var		width	= 1;
+        for ( var i = 0; i < count; ++i )
+            if ( keys[i].length + 1 > width )
+                width		= keys[i].length + 1;
+        var		buf	= _malloc( count * width + 1 );
+        var		raw	= _malloc( count * rawsiz + 1 );
+        var		cnf	= _malloc( count * 4 + 4 );
+        var		res	= -1;
+        var		ret;
+        try { // must de-allocate buf, raw and cnf after this point
+            HEAPU8.fill( 0, buf, buf + count * width );
+            HEAPU8.fill( 0, raw, raw + count * rawsiz );
+            for ( var i = 0; i < count; ++i ) {
+                var	key	= keys[i];
+                var	beg	= buf + i * width;
+                for ( var j = 0; j < key.length; ++j ) {
+                    var	c	= key.charCodeAt( j );
+                    HEAPU8[beg + j] = c < 0x80 ? c : 0x7f; // non-ASCII are invalid symbols
+                }
+            }
+            res			= func( rawsiz, buf, width, count, raw, cnf );
+            if ( res >= 0 )
+                ret		= {
+                    confidence:	HEAP32.slice( cnf >> 2, ( cnf >> 2 ) + count ),
+                    data:	HEAPU8.slice( raw, raw + count * rawsiz ),
+                    decoded:	res,
+                };
+        } finally {
+            _free( buf );
+            _free( raw );
+            _free( cnf );
+        }
+        if ( res < 0 )
+            throw new Error( func_name + "( " + rawsiz + ", ... ) failed" );
+        return ret;
+    }
+}
+
+rskey_2_decode_batch		= rskey_N_decode_batch_wrap( 'rskey_2_decode_batch' );
+rskey_3_decode_batch		= rskey_N_decode_batch_wrap( 'rskey_3_decode_batch' );
+rskey_4_decode_batch		= rskey_N_decode_batch_wrap( 'rskey_4_decode_batch' );
+rskey_5_decode_batch		= rskey_N_decode_batch_wrap( 'rskey_5_decode_batch' );
@@ -21,6 +21,8 @@
 // 
 %ignore *::encode;
 %ignore *::decode;
+%ignore *::decode_batch;
+%ignore *::batch_result;
 
 %include "exception.i"
 
@@ -41,6 +43,8 @@ namespace std {
     %template(uint8_vector)	vector<unsigned char>;
 }
 
+%include buffer.i
+
 %include ezpwd/bch
 
 %extend ezpwd::bch_base {
@@ -59,6 +63,61 @@ namespace std {
 	return oss.str();
     }
 
+    // 
+    // encode_buffer -- Encode all codewords in a buffer in-place, returning the number encoded
+    // decode_buffer -- Decode all codewords in a buffer in-place, returning the total bit corrections
+    // 
+    //     Accepts any C-contiguous, writable byte buffer (eg. bytearray, memoryview, NumPy uint8
+    // array) holding a whole number of codewords; each of 'len' data bytes followed by ecc_bytes()
+    // of parity.  Decoding returns -1 if any codeword was uncorrectable (see bch_base::decode_batch);
+    // each codeword's number of bit corrections (or -1) is returned in the optional results (int32)
+    // buffer.  The GIL is released while the codewords are processed.
+    // 
+    int				encode_buffer(
+				    PyObject	       *codewords,
+				    size_t		len )
+    {
+	ezpwd::py_buffer	cw( codewords,	"codewords",	true );
+	const size_t		stride	= len + $self->ecc_bytes();
+	const size_t		count	= cw.items() / stride;
+	if ( ! len || cw.items() != count * stride )
+	    throw std::runtime_error( "encode_buffer: codewords buffer must contain a whole number of codewords" );
+	const ezpwd::bch_base  *codec	= $self;
+	ezpwd::py_nogil( [&] {
+	    uint8_t	       *data	= cw.data<uint8_t>();
+	    for ( size_t i = 0; i < count; ++i, data += stride )
+		if ( codec->encode( data, len, data + len ) < 0 )
+		    throw std::runtime_error( "encode_buffer: could not encode data" );
+	} );
+	return int( count );
+    }
+
+    int				decode_buffer(
+				    PyObject	       *codewords,
+				    size_t		len,
+				    PyObject	       *results	= 0 )
+    {
+	ezpwd::py_buffer	cw( codewords,	"codewords",	true );
+	ezpwd::py_buffer	rs( results,	"results",	true,	"i", sizeof (int) );
+	const size_t		stride	= len + $self->ecc_bytes();
+	const size_t		count	= cw.items() / stride;
+	if ( ! len || cw.items() != count * stride )
+	    throw std::runtime_error( "decode_buffer: codewords buffer must contain a whole number of codewords" );
+	if ( rs.held && rs.items() < count )
+	    throw std::runtime_error( "decode_buffer: results buffer too small for all codewords" );
+	const ezpwd::bch_base  *codec	= $self;
+	int			total	= 0;
+	ezpwd::py_nogil( [&] {
+	    std::vector<ezpwd::bch_base::batch_result>
+				res( rs.held ? count : 0 );
+	    total			= codec->decode_batch( cw.data<uint8_t>(), len, stride, 0, 0, count,
+							       rs.held ? res.data() : 0 );
+	    for ( size_t i = 0; i < res.size(); ++i )
+		rs.data<int>()[i]	= res[i].corrects;
+	} );
+	return total;
+    }
+
     // 
     // Support some known container types for {en,de}coded template
     //
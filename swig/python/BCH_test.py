@@ -17,3 +17,79 @@ def test_simple():
     # Decode and test
     dec = flexi16.decoded( err )
     assert dec[:3] == ori
+
+
+def test_batch_throughput():
+    import BCH
+    import array
+    import random
+    import time
+
+    codec = BCH.BCH_255_223_4()
+    length = 16
+    ecc = codec.ecc_bytes()
+    stride = length + ecc
+    count = 20000
+
+    rnd = random.Random( 0 )
+    msgs = [ bytes( rnd.getrandbits( 8 ) for _ in range( length )) for _ in range( count ) ]
+
+    # Per-item, copying each codeword in and out of the codec
+    begun = time.time()
+    encs = [ bytes( codec.encoded( list( m ))) for m in msgs ]
+    item_enc = time.time() - begun
+
+    # Batch, in-place in a single buffer w/ room for each codeword's ECC
+    buf = bytearray( b''.join( m + bytes( ecc ) for m in msgs ))
+    begun = time.time()
+    assert codec.encode_buffer( buf, length ) == count
+    batch_enc = time.time() - begun
+    assert bytes( buf ) == b''.join( encs )
+
+    # Corrupt 1 bit of every 4th codeword's data; all should be corrected
+    for i in range( 0, count, 4 ):
+        buf[i * stride + i % length] ^= 1 << i % 8
+    errs = [ bytes( buf[i * stride:( i + 1 ) * stride] ) for i in range( count ) ]
+
+    begun = time.time()
+    decs = [ bytes( codec.decoded( list( e ))) for e in errs ]
+    item_dec = time.time() - begun
+
+    results = array.array( 'i', [ 0 ] * count )
+    begun = time.time()
+    assert codec.decode_buffer( buf, length, results ) == ( count + 3 ) // 4
+    batch_dec = time.time() - begun
+    assert list( results ) == [ 0 if i % 4 else 1 for i in range( count ) ]
+    assert bytes( buf ) == b''.join( encs )
+    assert [ d[:length] for d in decs ] == msgs
+
+    # Codewords w/ more bit errors than T are reported (not raised), and do not affect the rest
+    # (rarely, a shortened BCH codeword w/ T+1 errors may be mis-corrected, instead of rejected)
+    for b in range( 0, 8 * 5, 8 ):
+        buf[b // 8] ^= 1 << b % 8
+    total = codec.decode_buffer( buf, length, results )
+    assert ( total == -1 ) == ( results[0] == -1 )
+    assert results[1:].count( 0 ) == count - 1
+    assert bytes( buf[stride:] ) == b''.join( encs[1:] )
+
+    print( "%s: encode %8.0f/s per-item, %8.0f/s batch (%.1fx); decode %8.0f/s per-item, %8.0f/s batch (%.1fx)" % (
+        codec, count / item_enc, count / batch_enc, item_enc / batch_enc,
+        count / item_dec, count / batch_dec, item_dec / batch_dec ))
+
+
+def test_buffer_release():
+    import BCH
+    import array
+    import pytest
+
+    codec = BCH.BCH_255_223_4()
+    length = 16
+    buf = bytearray( 4 * ( length + codec.ecc_bytes() ))
+    assert codec.encode_buffer( buf, length ) == 4
+
+    # A results buffer w/ the wrong item type is rejected, and released; it may then be resized
+    for bad in ( array.array( 'd', [ 0.0 ] * 4 ), bytearray( 16 )):
+        with pytest.raises( RuntimeError ):
+            codec.decode_buffer( buf, length, bad )
+        bad.extend( bad[:1] )
+    buf.extend( bytes( length + codec.ecc_bytes() ))
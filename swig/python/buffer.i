@@ -0,0 +1,105 @@
+//
+// buffer.i -- Python buffer protocol support for the ezpwd batch {en,de}code bindings
+//
+//     Any object supporting the buffer protocol (bytes, bytearray, memoryview, array.array,
+// NumPy arrays, ...) may be supplied to the *_buffer methods, which process all of the codewords
+// (or coordinates) it holds in one native call, in place.  Buffers must be C-contiguous; typed
+// buffers (eg. float64 coordinates, int32 results) must have the expected item format and size.
+// While the native call runs, the views hold the buffers (they cannot be resized) and the GIL is
+// released, so other Python threads may run.
+//
+
+%{
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace ezpwd {
+    //
+    // py_buffer	-- An acquired, C-contiguous view of a Python buffer; released on destruction
+    //
+    //     A 0 (or None) object yields an empty, unheld view.  Raises std::runtime_error if the
+    // object does not support the buffer protocol (or is read-only, if writable), or if its items
+    // are not of the 'fmt' format (any of the supplied format characters; 0 for any 1-byte item).
+    //
+    struct py_buffer {
+	Py_buffer		view;
+	bool			held;
+
+				py_buffer(
+				    PyObject	       *obj,
+				    const char	       *name,
+				    bool		writable,
+				    const char	       *fmt	= 0,	// eg. "d" for float64
+				    size_t		itemsize= 1 )
+				    : view()
+				    , held( false )
+	{
+	    if ( ! obj || obj == Py_None )
+		return;
+	    if ( PyObject_GetBuffer( obj, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT
+				     | ( writable ? PyBUF_WRITABLE : 0 )) < 0 ) {
+		PyErr_Clear();
+		throw std::runtime_error( std::string( name ) + ": requires a C-contiguous"
+					  + ( writable ? " writable" : "" ) + " buffer" );
+	    }
+	    held			= true;
+	    const char	       *f	= view.format ? view.format : "B";
+	    if ( *f == '@' || *f == '=' || *f == '<' || *f == '!' || *f == '>' )
+		++f;
+	    if ( size_t( view.itemsize ) != itemsize || f[0] == 0 || f[1] != 0
+		 || ( fmt ? ! strchr( fmt, f[0] ) : ! strchr( "Bbc", f[0] ))) {
+		// The destructor won't run if we throw; release the view (and the export) here
+		std::string	what	= std::string( name ) + ": buffer has items of format '"
+					  + ( view.format ? view.format : "B" ) + "'; requires '"
+					  + ( fmt ? fmt : "B" ) + "' of " + std::to_string( itemsize )
+					  + " byte(s)";
+		PyBuffer_Release( &view );
+		held			= false;
+		throw std::runtime_error( what );
+	    }
+	}
+				py_buffer( const py_buffer & ) = delete;
+	py_buffer	       &operator=( const py_buffer & ) = delete;
+				~py_buffer()
+	{
+	    if ( held )
+		PyBuffer_Release( &view );
+	}
+
+	size_t			items()
+	    const
+	{
+	    return held ? size_t( view.len / view.itemsize ) : 0;
+	}
+
+	template < typename T >
+	T		       *data()
+	    const
+	{
+	    return held ? (T *)view.buf : 0;
+	}
+    };
+
+    //
+    // py_nogil	-- Invoke f() w/ the GIL released, re-raising any exception once it is re-acquired
+    //
+    template < typename F >
+    void			py_nogil(
+				    F			f )
+    {
+	std::string		error;
+	bool			failed	= false;
+	Py_BEGIN_ALLOW_THREADS
+	try {
+	    f();
+	} catch ( const std::exception &e ) {
+	    error			= e.what();
+	    failed			= true;
+	}
+	Py_END_ALLOW_THREADS
+	if ( failed )
+	    throw std::runtime_error( error );
+    }
+} // namespace ezpwd
+%}
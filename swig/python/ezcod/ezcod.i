@@ -12,6 +12,13 @@
 %ignore *::output;
 %ignore *::symbols;
 
+// 
+// The pointer-based {en,de}code_batch methods are replaced by the buffer protocol based
+// {en,de}code_buffer methods (see below).
+// 
+%ignore *::encode_batch;
+%ignore *::decode_batch;
+
 %include "exception.i"
 
 %exception {
@@ -22,6 +29,8 @@
     }
 }
 
+%include buffer.i
+
 %include ezpwd/ezcod
 
 %extend ezpwd::ezcod {
@@ -37,6 +46,76 @@
     {
 	return $self->encode( $self->precision ); // default to same precision as supplied
     }
+
+    // 
+    // encode_buffer -- Encode all lat/lon (float64) pairs into fixed-width, NUL-padded EZCODs
+    // decode_buffer -- Decode all fixed-width, NUL-padded EZCODs into lat/lon (float64) pairs
+    // 
+    //     Accepts any C-contiguous buffers (eg. bytearray, array.array('d'), NumPy arrays); see
+    // ezcod<P,L>::{en,de}code_batch.  The EZCOD of item i occupies codes[i*width,(i+1)*width);
+    // the default width is encode_size() + 1.  Each item's status (0 or an ERR_... code), or
+    // confidence (or an ERR_... code) is returned in the optional status, or required confidence
+    // (int32) buffer.  Returns the number of items successfully encoded/decoded.  The GIL is
+    // released while the items are processed.
+    // 
+    int				encode_buffer(
+				    PyObject	       *lat,
+				    PyObject	       *lon,
+				    PyObject	       *codes,
+				    PyObject	       *status	= 0,
+				    size_t		width	= 0 )
+    {
+	if ( ! width )
+	    width			= $self->encode_size() + 1;
+	ezpwd::py_buffer	la( lat,	"lat",		false,	"d", sizeof (double) );
+	ezpwd::py_buffer	lo( lon,	"lon",		false,	"d", sizeof (double) );
+	ezpwd::py_buffer	co( codes,	"codes",	true );
+	ezpwd::py_buffer	st( status,	"status",	true,	"i", sizeof (int) );
+	const size_t		count	= la.items();
+	if ( lo.items() != count )
+	    throw std::runtime_error( "encode_buffer: lat and lon must contain the same number of items" );
+	if ( co.items() < count * width )
+	    throw std::runtime_error( "encode_buffer: codes buffer too small for all items" );
+	if ( st.held && st.items() < count )
+	    throw std::runtime_error( "encode_buffer: status buffer too small for all items" );
+	int			done	= 0;
+	const auto	       *codec	= $self;
+	ezpwd::py_nogil( [&] {
+	    done			= codec->encode_batch( la.data<double>(), lo.data<double>(), count,
+							       co.data<char>(), width, st.data<int>() );
+	} );
+	return done;
+    }
+
+    int				decode_buffer(
+				    PyObject	       *codes,
+				    PyObject	       *lat,
+				    PyObject	       *lon,
+				    PyObject	       *confidence,
+				    PyObject	       *accuracy = 0,
+				    size_t		width	= 0 )
+    {
+	if ( ! width )
+	    width			= $self->encode_size() + 1;
+	ezpwd::py_buffer	co( codes,	"codes",	false );
+	ezpwd::py_buffer	la( lat,	"lat",		true,	"d", sizeof (double) );
+	ezpwd::py_buffer	lo( lon,	"lon",		true,	"d", sizeof (double) );
+	ezpwd::py_buffer	cf( confidence,	"confidence",	true,	"i", sizeof (int) );
+	ezpwd::py_buffer	ac( accuracy,	"accuracy",	true,	"d", sizeof (double) );
+	const size_t		count	= co.items() / width;
+	if ( co.items() != count * width )
+	    throw std::runtime_error( "decode_buffer: codes buffer must contain a whole number of EZCODs" );
+	if ( la.items() < count || lo.items() < count || cf.items() < count
+	     || ( ac.held && ac.items() < count ))
+	    throw std::runtime_error( "decode_buffer: lat, lon, confidence or accuracy buffer too small for all items" );
+	int			done	= 0;
+	const auto	       *codec	= $self;
+	ezpwd::py_nogil( [&] {
+	    done			= codec->decode_batch( co.data<const char>(), width, count, la.data<double>(),
+							       lo.data<double>(), cf.data<int>(), ac.data<double>() );
+	} );
+	return done;
+    }
 };
 
 // Define the EZCOD Python API classes available
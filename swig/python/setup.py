@@ -16,11 +16,12 @@ ezcod_module			= Extension(
     ],
     include_dirs		= [ "../../c++" ],
     swig_opts			= [ "-c++",
+                                      "-I.",
                                       "-I./ezcod",
                                       "-I../../c++",
                                     "-outdir",
                                       "ezcod" ],
-    extra_compile_args		= [ "-std=c++11", "-O3" ],
+    extra_compile_args		= [ "-std=c++14", "-O3" ],
     libraries			= []
 )
 
@@ -32,14 +33,15 @@ bch_module			= Extension(
     include_dirs		= [ "../../c++",
                                     "../../c++/ezpwd/bch_include" ],
     swig_opts			= [ "-c++",
+                                      "-I.",
                                       "-I./BCH",
                                       "-I../../c++",
                                       "-I../../c++/ezpwd/bch_include",
                                     "-outdir",
                                       "BCH" ],
     extra_objects		= [ "../../djelic_bch.o" ],
-    extra_compile_args		= [ "-std=c++11", "-O3" ],
-    extra_link_args		= [ "-std=c++11", "-O3" ],
+    extra_compile_args		= [ "-std=c++14", "-O3" ],
+    extra_link_args		= [ "-std=c++14", "-O3" ],
     libraries			= []
 )
 